@@ -13,6 +13,8 @@
 // This code requires C++11 compatible compiler.
 
 #include <iostream>
+#include <fstream>
+#include <sstream>
 #include <map>
 #include <unordered_map>
 using namespace std;
@@ -109,6 +111,64 @@ std::unordered_map<string, TokenType> keywordMap = {
 };
 
 
+// Load the keywords of a language dialect on top of the current keyword set.
+// Each line of the input either adds a keyword, followed by the name of the
+// keyword token it produces, or removes a keyword when prefixed with -.
+// For example, this renames function to func and adds elif:
+//     -function
+//     func    function
+//     elif    if
+// Empty lines and lines starting with # are skipped. Keywords must look like
+// identifiers and can only produce keyword tokens (int ... break). Loaded
+// keywords go into keywordMap, so lookups stay exactly as fast as with the
+// built in keywords. Returns false and leaves keywordMap untouched if the
+// input is malformed, cannot be read or does not contain any keywords.
+bool loadKeywords(istream & input)
+{
+    // keyword tokens are the TokenType range from Int to Break
+    auto first = tokenTypeMap.find(TokenType::Int);
+    auto last = tokenTypeMap.upper_bound(TokenType::Break);
+    
+    auto keywords = keywordMap;
+    bool changed = false;
+    string line;
+    while (getline(input, line)) {
+        // split the line into a keyword and an optional token name
+        istringstream fields(line);
+        string keyword, name, extra;
+        if (!(fields >> keyword) || keyword[0] == '#') continue;
+        fields >> name;
+        if (fields >> extra) return false;
+        
+        // a leading - removes the keyword
+        bool remove = keyword[0] == '-';
+        if (remove) keyword.erase(0, 1);
+        
+        // keyword must be something identifier() can return
+        if (keyword.empty() || !isalpha(keyword[0])) return false;
+        for (auto ch : keyword) if (!isalnum(ch)) return false;
+        
+        if (remove) {
+            if (!name.empty() || keywords.erase(keyword) == 0) return false;
+        } else {
+            // find the keyword token by its name
+            auto it = first;
+            while (it != last && it->second != name) it++;
+            if (it == last) return false;
+            keywords[keyword] = it->first;
+        }
+        changed = true;
+    }
+    
+    // stop if reading failed or there was nothing to load
+    if (input.bad() || !changed) return false;
+    
+    // Done. Replace the current keywords
+    keywordMap.swap(keywords);
+    return true;
+}
+
+
 // Token structure represents a very simple Token that is returned from
 // the lexer. This here holds the token TokenType and its textual value
 struct Token {
@@ -289,6 +349,19 @@ private:
 // Main entry point
 int main(int argc, const char * argv[])
 {
+    // tokens are printed with cout only, so there is no need to keep it
+    // in sync with C stdio. This lets cout buffer the output by itself
+    ios::sync_with_stdio(false);
+    
+    // optionally load the keywords of a dialect from a file
+    if (argc > 1) {
+        ifstream file(argv[1]);
+        if (!file || !loadKeywords(file)) {
+            cerr << "Failed to load keywords from " << argv[1] << '\n';
+            return 1;
+        }
+    }
+    
     // simple app
     Lexer lexer(
         "function fib(int n) : int {\n"
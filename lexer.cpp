@@ -159,6 +159,10 @@ private:
 // Main entry point
 int main(int argc, const char * argv[])
 {
+    // tokens are printed with cout only, so there is no need to keep it
+    // in sync with C stdio. This lets cout buffer the output by itself
+    ios::sync_with_stdio(false);
+    
     // create the lexer object and pass in a very simple expression
     // expression has 2 identifiers (rad, pi), 2 operators (=, /), a number(180)
     // and a comment starting with // and ends with a new line.